@@ -4,49 +4,133 @@
 #include <chrono>
 #include <iterator>
 #include <set>
+#include <random>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 
 using namespace std;
 
 typedef unsigned int uint;
 typedef long int lint;
 typedef unsigned long int ulint;
-typedef vector < vector <double> > matrix;
-typedef pair < vector <uint>, double > tSolution;
 
-double evaluateUtility (matrix A, vector <uint> solution) {
-    double result = 0.0;
+// integral coefficients are stored in 16 or 32 bits and accumulated in 64 bits
+template <typename T> struct accumulator { typedef lint type; };
+template <> struct accumulator <double> { typedef double type; };
+
+template <typename T> using matrix = vector < vector <T> >;
+template <typename T> using tValue = typename accumulator <T> :: type;
+template <typename V> using tSolution = pair < vector <uint>, V >;
+typedef pair < pair <uint, uint>, double > tDelta; // ((i, j), new value)
+
+const double EPSILON = 1e-9;
+const double DESTRUCTION_RATE = 0.3; // share of a warm solution dropped before each re-solve construction
+
+template <typename T>
+tValue <T> evaluateUtility (const matrix <T> & A, const vector <uint> & solution) {
+    tValue <T> result = 0;
     for (uint i = 0; i < A.size(); i++) {
         for (uint j = 0; j < A[i].size(); j++) {
-            result += solution[i] * A[i][j] * solution[j];
+            result += tValue <T> (solution[i]) * A[i][j] * solution[j];
         }
     }
     return result;
 }
 
-double evaluatecontribuition (matrix A, vector <uint> solution, uint i) {
-    double result = A[i][i];
-    for (uint j = 0; j < A[i].size(); j++) {
-        if (i != j) {
-            result += solution[j] * (A[i][j] + A[j][i]);
+template <typename T>
+tValue <T> evaluatecontribuition (const matrix <T> & A, const vector <uint> & solution, uint i) {
+    // the matrix is triangular superior: the column above 'i' and the row after it
+    tValue <T> result = A[i][i];
+    for (uint j = 0; j < i; j++) {
+        result += tValue <T> (solution[j]) * A[j][i];
+    }
+    const T * row = A[i].data();
+    uint n = A.size();
+    for (uint j = i + 1; j < n; j++) {
+        result += tValue <T> (solution[j]) * row[j];
+    }
+    return result;
+}
+
+template <typename T>
+vector < tValue <T> > evaluateGains (const matrix <T> & A, const vector <uint> & solution) {
+    // gains[i] is the utility variation of flipping 'i' (added if 'i' is out, removed if 'i' is in)
+    uint n = A.size();
+    vector < tValue <T> > result (n, 0);
+    for (uint i = 0; i < n; i++) {
+        const T * row = A[i].data();
+        tValue <T> xi = solution[i];
+        tValue <T> sum = row[i];
+        for (uint j = i + 1; j < n; j++) { // the matrix is triangular superior
+            sum += tValue <T> (solution[j]) * row[j];
+            result[j] += xi * row[j];
         }
+        result[i] += sum;
     }
     return result;
 }
 
-tSolution greedyRandomizedConstruction (matrix A, double alpha, default_random_engine generator) {
-    tSolution result = make_pair(vector <uint> (A.size(), 0), 0.0);
+template <typename T>
+void flip (const matrix <T> * A, vector < tValue <T> > * gains, tSolution < tValue <T> > * solution, uint i) {
+    // O(n) update of the solution, its utility and the cached gains
+    tValue <T> sign = 1;
+    if ((*solution).first[i] == 0) {
+        (*solution).first[i] = 1;
+        (*solution).second += (*gains)[i];
+    } else {
+        sign = -1;
+        (*solution).first[i] = 0;
+        (*solution).second -= (*gains)[i];
+    }
+    // the matrix is triangular superior: the column above 'i' and the row after it
+    tValue <T> * g = (*gains).data();
+    for (uint j = 0; j < i; j++) {
+        g[j] += sign * (*A)[j][i];
+    }
+    const T * row = (*A)[i].data();
+    uint n = (*A).size();
+    for (uint j = i + 1; j < n; j++) {
+        g[j] += sign * row[j];
+    }
+}
+
+template <typename T>
+void applyDelta (matrix <T> * A, vector < tValue <T> > * gains, tSolution < tValue <T> > * solution, uint i, uint j, T value) {
+    // O(1) update of the matrix, the cached gains and the utility of the solution
+    if (i >= (*A).size() || j >= (*A).size()) {
+        return;
+    }
+    if (i > j) { // the matrix is triangular superior
+        swap(i, j);
+    }
+    tValue <T> delta = tValue <T> (value) - (*A)[i][j];
+    (*A)[i][j] = value;
+    if (i == j) {
+        (*gains)[i] += delta;
+        (*solution).second += (*solution).first[i] * delta;
+    } else {
+        (*gains)[i] += (*solution).first[j] * delta;
+        (*gains)[j] += (*solution).first[i] * delta;
+        (*solution).second += (*solution).first[i] * (*solution).first[j] * delta;
+    }
+}
+
+template <typename T>
+tSolution < tValue <T> > greedyRandomizedConstruction (const matrix <T> & A, double alpha, default_random_engine & generator, tSolution < tValue <T> > result) {
+    // completes the partial solution 'result', which is empty on a cold start
     bool flag = true;
     while (flag) {
-        double minUtility = 0, maxUtility = 0;
+        tValue <T> minUtility = 0, maxUtility = 0;
         bool flag2 = true;
-        vector < pair <uint, double> > candidateList;
+        vector < pair <uint, tValue <T> > > candidateList;
         for (uint i = 0; i < A.size(); i++) {
-            tSolution solution;
+            tSolution < tValue <T> > solution;
             solution.first = vector <uint> (result.first);
             solution.second = result.second;
             if (solution.first[i] == 0) { // if 'i' is not in solution
                 solution.first[i] = 1;
-                double contribuition = evaluatecontribuition(A, solution.first, i);
+                tValue <T> contribuition = evaluatecontribuition(A, solution.first, i);
                 solution.second += contribuition;
                 if (solution.second >= result.second) { // if 'i' can improve solution
                     candidateList.push_back(make_pair(i, contribuition));
@@ -67,9 +151,9 @@ tSolution greedyRandomizedConstruction (matrix A, double alpha, default_random_e
         // compute restriction
         double restriction = maxUtility - alpha * (maxUtility - minUtility);
         // populate RCL
-        vector < pair <uint, double> > restrictedCandidateList;
-        for (vector < pair <uint, double> > :: iterator it = candidateList.begin(); it != candidateList.end(); it++) {
-            pair <uint, double> candidate = *it;
+        vector < pair <uint, tValue <T> > > restrictedCandidateList;
+        for (typename vector < pair <uint, tValue <T> > > :: iterator it = candidateList.begin(); it != candidateList.end(); it++) {
+            pair <uint, tValue <T> > candidate = *it;
             if (candidate.second >= restriction) {
                 restrictedCandidateList.push_back(candidate);
             }
@@ -77,9 +161,9 @@ tSolution greedyRandomizedConstruction (matrix A, double alpha, default_random_e
         if (restrictedCandidateList.size() > 0) {
             uniform_int_distribution <uint> distribution (0, restrictedCandidateList.size() - 1);
             uint s = distribution(generator);
-            pair <uint, double> candidate = restrictedCandidateList[s];
+            pair <uint, tValue <T> > candidate = restrictedCandidateList[s];
             uint i = candidate.first;
-            uint deltaUtility = candidate.second;
+            tValue <T> deltaUtility = candidate.second;
             result.first[i] = 1;
             result.second += deltaUtility;
         } else {
@@ -90,7 +174,8 @@ tSolution greedyRandomizedConstruction (matrix A, double alpha, default_random_e
     return result;
 }
 
-bool isFeasible (tSolution solution) {
+template <typename V>
+bool isFeasible (tSolution <V> solution) {
     for (uint i = 0; i < solution.first.size(); i++) {
         if (solution.first[i] == 1) {
             if (i > 0 && solution.first[i - 1] == 1) {
@@ -104,7 +189,8 @@ bool isFeasible (tSolution solution) {
     return true;
 }
 
-void repair (matrix A, tSolution * solution) {
+template <typename T>
+void repair (const matrix <T> & A, tSolution < tValue <T> > * solution) {
     // desligar bits até se tornar factível
     // dar preferencia pros bits que violam mais restricões
     // em caso de empate, dar preferencia pros que diminuem menos a utilidade
@@ -133,16 +219,16 @@ void repair (matrix A, tSolution * solution) {
             if (restrictionsViolatedCounter[chosenBit] < restrictionsViolatedCounter[i]) {
                 chosenBit = i;
             } else if (restrictionsViolatedCounter[chosenBit] == restrictionsViolatedCounter[i]) {
-                tSolution chosenNewSolution;
+                tSolution < tValue <T> > chosenNewSolution;
                 chosenNewSolution.first = vector <uint> ((*solution).first);
                 chosenNewSolution.second = (*solution).second;
-                double chosenContribution = evaluatecontribuition(A, chosenNewSolution.first, chosenBit);
+                tValue <T> chosenContribution = evaluatecontribuition(A, chosenNewSolution.first, chosenBit);
                 chosenNewSolution.first[chosenBit] = 0;
                 chosenNewSolution.second -= chosenContribution;
-                tSolution newSolution;
+                tSolution < tValue <T> > newSolution;
                 newSolution.first = vector <uint> ((*solution).first);
                 newSolution.second = (*solution).second;
-                double newContribution = evaluatecontribuition(A, newSolution.first, i);
+                tValue <T> newContribution = evaluatecontribuition(A, newSolution.first, i);
                 newSolution.first[i] = 0;
                 newSolution.second -= newContribution;
                 if (chosenNewSolution.second < newSolution.second) {
@@ -150,72 +236,199 @@ void repair (matrix A, tSolution * solution) {
                 }
             }
         }
-        double contribuition = evaluatecontribuition(A, (*solution).first, chosenBit);
+        tValue <T> contribuition = evaluatecontribuition(A, (*solution).first, chosenBit);
         (*solution).first[chosenBit] = 0;
         (*solution).second -= contribuition;
         invalidBits.erase(chosenBit);
     }
 }
 
-void localSearch (matrix A, int searchMethod, default_random_engine generator, tSolution * solution) {
-    vector < vector <uint> > neighborhood;
-    // 1Flip neighborhood
-    for (uint i = 0; i < A.size(); i++) {
-        vector <uint> neighbor;
-        neighbor.push_back(i);
-        neighborhood.push_back(neighbor);
+template <typename V>
+uint bitAfterMove (tSolution <V> * solution, const uint * move, uint count, uint p) {
+    // value of bit 'p' once the 'count' bits in 'move' are flipped
+    uint bit = (*solution).first[p];
+    for (uint l = 0; l < count; l++) {
+        if (move[l] == p) {
+            bit = 1 - bit;
+        }
     }
-    // 2Flip neighborhood
-    for (uint i = 0; i < A.size(); i++) {
-        for (uint j = i + 1; j < A.size(); j++) {
-            vector <uint> neighbor;
-            neighbor.push_back(i);
-            neighbor.push_back(j);
-            neighborhood.push_back(neighbor);
-        }
-    }
-    // 3Flip neighborhood
-/*    for (uint i = 0; i < A.size(); i++) {
-        for (uint j = i + 1; j < A.size(); j++) {
-            for (uint k = j + 1; k < A.size(); k++) {
-                vector <uint> neighbor;
-                neighbor.push_back(i);
-                neighbor.push_back(j);
-                neighbor.push_back(k);
-                neighborhood.push_back(neighbor);
+    return bit;
+}
+
+template <typename V>
+bool isFeasibleMove (tSolution <V> * solution, const uint * move, uint count) {
+    // checks only the neighborhood of the flipped bits, assuming the solution is feasible
+    uint n = (*solution).first.size();
+    for (uint l = 0; l < count; l++) {
+        uint i = move[l];
+        if (bitAfterMove(solution, move, count, i) == 1) {
+            if (i > 0 && bitAfterMove(solution, move, count, i - 1) == 1) {
+                return false;
+            }
+            if (i < n - 1 && bitAfterMove(solution, move, count, i + 1) == 1) {
+                return false;
             }
         }
     }
-*/
-    shuffle (neighborhood.begin(), neighborhood.end(), generator);
-    bool flag = true;
-    for (vector < vector <uint> > :: iterator it = neighborhood.begin(); flag && it != neighborhood.end(); it++) {
-        vector <uint> neighbor = *it;
-        tSolution newSolution = make_pair(vector <uint> ((*solution).first), (*solution).second);
-        for (vector <uint> :: iterator it2 = neighbor.begin(); it2 != neighbor.end(); it2++) {
-            uint i = *it2;
-            double contribuition = evaluatecontribuition(A, newSolution.first, i);
-            if (newSolution.first[i] == 0) {
-                newSolution.first[i] = 1;
-                newSolution.second += contribuition;
-            } else {
-                newSolution.first[i] = 0;
-                newSolution.second -= contribuition;
+    return true;
+}
+
+template <typename V>
+int sign (tSolution <V> * solution, uint i) {
+    // +1 if flipping 'i' adds it to the solution, -1 if it removes it
+    return (*solution).first[i] == 0 ? 1 : -1;
+}
+
+template <typename T>
+tValue <T> pairTerm (const matrix <T> * A, tSolution < tValue <T> > * solution, uint i, uint j) {
+    // interaction between the flips of 'i' and 'j'
+    return tValue <T> (sign(solution, i) * sign(solution, j)) * (tValue <T> ((*A)[i][j]) + (*A)[j][i]);
+}
+
+template <typename V>
+bool oneFlipMove (vector <V> * delta, vector <uint> * order, int searchMethod, tSolution <V> * solution, vector <uint> * move) {
+    double bestDelta = EPSILON;
+    bool found = false;
+    for (uint a = 0; a < (*order).size() && (*delta)[(*order)[a]] > bestDelta; a++) {
+        uint i = (*order)[a];
+        if (isFeasibleMove(solution, &i, 1)) {
+            found = true;
+            bestDelta = (*delta)[i];
+            *move = vector <uint> (1, i);
+            if (searchMethod == 0) {
+                return true;
             }
         }
-/*
-        if (!isFeasible(newSolution)) {
-            repair (A, &newSolution);
+    }
+    return found;
+}
+
+template <typename T>
+bool twoFlipMove (const matrix <T> * A, vector < tValue <T> > * delta, vector <uint> * order, int searchMethod, tValue <T> bound, bool swapMove, tSolution < tValue <T> > * solution, vector <uint> * move) {
+    // swap moves pair a bit in the solution with a bit out of it, 2-flip moves pair bits in the same state
+    double bestDelta = EPSILON;
+    bool found = false;
+    uint n = (*order).size();
+    for (uint a = 0; a + 1 < n; a++) {
+        uint i = (*order)[a];
+        if ((*delta)[i] + (*delta)[(*order)[a + 1]] + bound <= bestDelta) {
+            break;
         }
-*/
-        if (isFeasible(newSolution) && newSolution.second > (*solution).second) {
-            (*solution).first = vector <uint> (newSolution.first);
-            (*solution).second = newSolution.second;
-            if (searchMethod == 0) {
-                flag = false;
+        for (uint b = a + 1; b < n; b++) {
+            uint j = (*order)[b];
+            if ((*delta)[i] + (*delta)[j] + bound <= bestDelta) {
+                break;
+            }
+            if (swapMove == ((*solution).first[i] == (*solution).first[j])) {
+                continue;
+            }
+            tValue <T> d = (*delta)[i] + (*delta)[j] + pairTerm(A, solution, i, j);
+            if (d > bestDelta) {
+                uint neighbor[2] = {i, j};
+                if (isFeasibleMove(solution, neighbor, 2)) {
+                    found = true;
+                    bestDelta = d;
+                    *move = vector <uint> (neighbor, neighbor + 2);
+                    if (searchMethod == 0) {
+                        return true;
+                    }
+                }
             }
         }
     }
+    return found;
+}
+
+template <typename T>
+bool threeFlipMove (const matrix <T> * A, vector < tValue <T> > * delta, vector <uint> * order, int searchMethod, tValue <T> bound, tSolution < tValue <T> > * solution, vector <uint> * move) {
+    double bestDelta = EPSILON;
+    bool found = false;
+    uint n = (*order).size();
+    for (uint a = 0; a + 2 < n; a++) {
+        uint i = (*order)[a];
+        if ((*delta)[i] + (*delta)[(*order)[a + 1]] + (*delta)[(*order)[a + 2]] + 3 * bound <= bestDelta) {
+            break;
+        }
+        for (uint b = a + 1; b + 1 < n; b++) {
+            uint j = (*order)[b];
+            if ((*delta)[i] + (*delta)[j] + (*delta)[(*order)[b + 1]] + 3 * bound <= bestDelta) {
+                break;
+            }
+            tValue <T> dij = (*delta)[i] + (*delta)[j] + pairTerm(A, solution, i, j);
+            for (uint c = b + 1; c < n; c++) {
+                uint k = (*order)[c];
+                if (dij + (*delta)[k] + 2 * bound <= bestDelta) {
+                    break;
+                }
+                tValue <T> d = dij + (*delta)[k] + pairTerm(A, solution, i, k) + pairTerm(A, solution, j, k);
+                if (d > bestDelta) {
+                    uint neighbor[3] = {i, j, k};
+                    if (isFeasibleMove(solution, neighbor, 3)) {
+                        found = true;
+                        bestDelta = d;
+                        *move = vector <uint> (neighbor, neighbor + 3);
+                        if (searchMethod == 0) {
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return found;
+}
+
+template <typename T>
+void variableNeighborhoodDescent (const matrix <T> * A, vector < tValue <T> > * gains, int searchMethod, default_random_engine & generator, tSolution < tValue <T> > * solution) {
+    // cycles 1-flip -> swap -> 2-flip -> 3-flip, restarting from 1-flip after each improvement
+    // moves are evaluated from the cached gains and pairwise terms, visiting the bits in
+    // decreasing order of their 1-flip delta so that pairs and triples whose delta is bounded
+    // by the best move found so far are pruned
+    uint n = (*A).size();
+    tValue <T> bound = 0; // largest absolute pairwise term
+    for (uint i = 0; i < n; i++) {
+        for (uint j = i + 1; j < n; j++) {
+            bound = max(bound, abs(tValue <T> ((*A)[i][j]) + (*A)[j][i]));
+        }
+    }
+    vector <uint> order (n);
+    for (uint i = 0; i < n; i++) {
+        order[i] = i;
+    }
+    vector < tValue <T> > delta (n);
+    uint k = 0;
+    while (k < 4) {
+        for (uint i = 0; i < n; i++) {
+            delta[i] = sign(solution, i) * (*gains)[i];
+        }
+        shuffle(order.begin(), order.end(), generator); // ties are broken at random
+        stable_sort(order.begin(), order.end(), [&delta] (uint i, uint j) { return delta[i] > delta[j]; });
+        vector <uint> move;
+        bool found = false;
+        if (k == 0) {
+            found = oneFlipMove(&delta, &order, searchMethod, solution, &move);
+        } else if (k == 1) {
+            found = twoFlipMove(A, &delta, &order, searchMethod, bound, true, solution, &move);
+        } else if (k == 2) {
+            found = twoFlipMove(A, &delta, &order, searchMethod, bound, false, solution, &move);
+        } else {
+            found = threeFlipMove(A, &delta, &order, searchMethod, bound, solution, &move);
+        }
+        if (found) {
+            for (vector <uint> :: iterator it = move.begin(); it != move.end(); it++) {
+                flip(A, gains, solution, *it);
+            }
+            k = 0;
+        } else {
+            k++;
+        }
+    }
+}
+
+template <typename T>
+void localSearch (const matrix <T> & A, int searchMethod, default_random_engine & generator, tSolution < tValue <T> > * solution) {
+    vector < tValue <T> > gains = evaluateGains(A, (*solution).first);
+    variableNeighborhoodDescent(&A, &gains, searchMethod, generator, solution);
 }
 
 bool termination (chrono :: high_resolution_clock :: time_point tBegin, ulint timeLimit) {
@@ -227,18 +440,41 @@ bool termination (chrono :: high_resolution_clock :: time_point tBegin, ulint ti
     return false;
 }
 
-tSolution grasp (matrix A, ulint seed, ulint timeLimit, int searchMethod, double alpha, chrono :: high_resolution_clock :: time_point tBegin) {
-    tSolution result;
+template <typename T>
+tSolution < tValue <T> > perturb (const matrix <T> & A, tSolution < tValue <T> > solution, default_random_engine & generator) {
+    // drop each bit of the solution with probability DESTRUCTION_RATE
+    bernoulli_distribution distribution (DESTRUCTION_RATE);
+    for (uint i = 0; i < solution.first.size(); i++) {
+        if (solution.first[i] == 1 && distribution(generator)) {
+            solution.first[i] = 0;
+        }
+    }
+    solution.second = evaluateUtility(A, solution.first);
+    return solution;
+}
+
+template <typename T>
+tSolution < tValue <T> > grasp (const matrix <T> & A, ulint seed, ulint timeLimit, int searchMethod, double alpha, chrono :: high_resolution_clock :: time_point tBegin, tSolution < tValue <T> > warmSolution) {
+    tSolution < tValue <T> > result;
 
     default_random_engine generator (seed);
 
     bool flag = true;
-    while (termination (tBegin, timeLimit) != true) {
-        tSolution solution = greedyRandomizedConstruction(A, alpha, generator);
-        localSearch(A, searchMethod, generator, &solution);
+    bool warm = warmSolution.first.size() == A.size();
+    if (warm) { // seed the incumbent with the prior solution
+        flag = false;
+        result = warmSolution;
+    }
+    while (flag || termination (tBegin, timeLimit) != true) {
+        tSolution < tValue <T> > solution = make_pair(vector <uint> (A.size(), 0), tValue <T> (0));
+        if (warm) { // construct around the incumbent instead of from scratch
+            solution = perturb(A, result, generator);
+        }
+        solution = greedyRandomizedConstruction(A, alpha, generator, solution);
         if (!isFeasible(solution)) {
             repair(A, &solution);
         }
+        localSearch(A, searchMethod, generator, &solution);
 
         if (flag || result.second < solution.second) {
             flag = false;
@@ -248,12 +484,167 @@ tSolution grasp (matrix A, ulint seed, ulint timeLimit, int searchMethod, double
     return result;
 }
 
+template <typename T>
+tSolution < tValue <T> > resolve (matrix <T> * A, vector < tValue <T> > * gains, ulint seed, ulint timeLimit, int searchMethod, double alpha, chrono :: high_resolution_clock :: time_point tBegin, tSolution < tValue <T> > solution) {
+    // continue GRASP from a prior solution whose utility and gains are already up to date
+    if (!isFeasible(solution)) {
+        repair(*A, &solution);
+        *gains = evaluateGains(*A, solution.first);
+    }
+    default_random_engine generator (seed);
+    variableNeighborhoodDescent(A, gains, searchMethod, generator, &solution);
+    tSolution < tValue <T> > result = grasp(*A, seed, timeLimit, searchMethod, alpha, tBegin, solution);
+    if (result.first != solution.first) {
+        *gains = evaluateGains(*A, result.first);
+    }
+    return result;
+}
+
+template <typename T>
+bool isRepresentable (double value) {
+    return value >= numeric_limits <T> :: lowest() && value <= numeric_limits <T> :: max() && T (value) == value;
+}
+
+template <typename T>
+bool isRepresentable (const matrix <double> & A) {
+    for (uint i = 0; i < A.size(); i++) {
+        for (uint j = 0; j < A[i].size(); j++) {
+            if (!isRepresentable <T> (A[i][j])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename T>
+bool isRepresentable (const vector <tDelta> & deltas) {
+    for (uint l = 0; l < deltas.size(); l++) {
+        if (!isRepresentable <T> (deltas[l].second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T, typename S>
+matrix <T> convert (const matrix <S> & A) {
+    matrix <T> result (A.size(), vector <T> (A.size(), 0));
+    for (uint i = 0; i < A.size(); i++) {
+        for (uint j = 0; j < A[i].size(); j++) {
+            result[i][j] = T (A[i][j]);
+        }
+    }
+    return result;
+}
+
+int readDelta (uint n, vector <tDelta> * deltas) {
+    // read a block <k> followed by 'k' updates <i> <j> <new value>
+    // returns 1 if a block was read, 0 at the end of the input and -1 if the block is invalid
+    uint k;
+    (*deltas).clear();
+    if (!(cin >> k)) {
+        if (cin.eof()) {
+            return 0;
+        }
+        cerr << "invalid delta block size" << endl;
+        return -1;
+    }
+    for (uint l = 0; l < k; l++) {
+        uint i, j;
+        double value;
+        if (!(cin >> i >> j >> value)) {
+            cerr << "delta block truncated or malformed at update " << l + 1 << " of " << k << endl;
+            return -1;
+        }
+        if (i >= n || j >= n) {
+            cerr << "delta update (" << i << ", " << j << ") out of range for n = " << n << endl;
+            return -1;
+        }
+        if (!isfinite(value)) {
+            cerr << "delta update (" << i << ", " << j << ") has a non-finite value" << endl;
+            return -1;
+        }
+        (*deltas).push_back(make_pair(make_pair(i, j), value));
+    }
+    return 1;
+}
+
+bool readSolution (uint n, vector <uint> * solution) {
+    *solution = vector <uint> (n, 0);
+    for (uint i = 0; i < n; i++) {
+        if (!(cin >> (*solution)[i]) || (*solution)[i] > 1) {
+            cerr << "prior solution entry " << i << " is missing or not binary" << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename V>
+void printSolution (tSolution <V> solution, chrono :: high_resolution_clock :: time_point tBegin) {
+    cout << "maxVal = " << solution.second << endl;
+
+    chrono :: high_resolution_clock :: time_point tEnd = chrono :: high_resolution_clock :: now();
+    chrono :: seconds elapsedTime = chrono :: duration_cast <chrono :: seconds> (tEnd - tBegin);
+
+    cout << "Time = " << elapsedTime.count() << " seg" << endl;
+
+    cout << "Solution: " << endl;
+    for (uint i = 0; i < solution.first.size(); i++) {
+        cout << solution.first[i] << endl;
+    }
+}
+
+template <typename T>
+int resolveSession (matrix <T> A, tSolution < tValue <T> > solution, vector < tValue <T> > gains, vector <tDelta> deltas, ulint seed, ulint resolveTimeLimit, int searchMethod, double alpha) {
+    // apply the pending deltas, re-solve from the last solution and repeat for every delta block left in the input
+    while (true) {
+        chrono :: high_resolution_clock :: time_point tBegin = chrono :: high_resolution_clock :: now();
+        if (!isRepresentable <T> (deltas)) {
+            // widen the storage so that no update is lost: int32 for integral deltas, double otherwise
+            if (isRepresentable <int32_t> (deltas)) {
+                return resolveSession(convert <int32_t> (A), make_pair(solution.first, tValue <int32_t> (solution.second)), vector < tValue <int32_t> > (gains.begin(), gains.end()), deltas, seed, resolveTimeLimit, searchMethod, alpha);
+            }
+            return resolveSession(convert <double> (A), make_pair(solution.first, tValue <double> (solution.second)), vector < tValue <double> > (gains.begin(), gains.end()), deltas, seed, resolveTimeLimit, searchMethod, alpha);
+        }
+        for (vector <tDelta> :: iterator it = deltas.begin(); it != deltas.end(); it++) {
+            applyDelta(&A, &gains, &solution, (*it).first.first, (*it).first.second, T ((*it).second));
+        }
+        solution = resolve(&A, &gains, seed, resolveTimeLimit, searchMethod, alpha, tBegin, solution);
+        printSolution(solution, tBegin);
+        int status = readDelta(A.size(), &deltas);
+        if (status <= 0) {
+            return -status;
+        }
+    }
+}
+
+template <typename T>
+int solve (matrix <T> A, int warm, vector <uint> priorSolution, vector <tDelta> deltas, ulint seed, ulint timeLimit, ulint resolveTimeLimit, int searchMethod, double alpha, chrono :: high_resolution_clock :: time_point tBegin) {
+    if (!warm) {
+        printSolution(grasp(A, seed, timeLimit, searchMethod, alpha, tBegin, tSolution < tValue <T> > ()), tBegin);
+        return 0;
+    }
+    tSolution < tValue <T> > solution = make_pair(priorSolution, evaluateUtility(A, priorSolution));
+    vector < tValue <T> > gains = evaluateGains(A, priorSolution);
+    return resolveSession(A, solution, gains, deltas, seed, resolveTimeLimit, searchMethod, alpha);
+}
+
+// usage: grasp [seed] [timeLimit] [searchMethod] [alpha] [warm] [resolveTimeLimit] < input
+// the input is an instance (see instances/README); if warm = 1 the instance is followed by a prior
+// solution (n entries, 0 or 1) and by zero or more delta blocks, each <k> followed by 'k' lines
+// <i> <j> <new value>; the prior solution and every block are re-solved in turn, starting from the
+// last solution: a VND from it plus resolveTimeLimit seconds of GRASP (default 0, VND only) whose
+// constructions complete a randomly thinned copy of the incumbent instead of starting from scratch
 int main (int argc, char * argv[]) {
     chrono :: high_resolution_clock :: time_point tBegin = chrono :: high_resolution_clock :: now();
     ulint seed = 0;
     ulint timeLimit = 10;
-    int searchMethod; // 0 = first-improving; 1 = best-improving
+    int searchMethod = 0; // 0 = first-improving; 1 = best-improving
     double alpha = 0.5;
+    int warm = 0; // 0 = cold start; 1 = read a prior solution and delta blocks after the matrix
+    ulint resolveTimeLimit = 0;
 
     if (argc >= 2) {
         seed = atoi(argv[1]);
@@ -271,6 +662,14 @@ int main (int argc, char * argv[]) {
         alpha = atof(argv[4]);
     }
 
+    if (argc >= 6) {
+        warm = atoi(argv[5]);
+    }
+
+    if (argc >= 7) {
+        resolveTimeLimit = atoi(argv[6]);
+    }
+
     if (seed == 0) {
         seed = tBegin.time_since_epoch().count();
     }
@@ -291,7 +690,7 @@ int main (int argc, char * argv[]) {
 
     cin >> n;
 
-    matrix A (n, vector <double> (n, 0.0));
+    matrix <double> A (n, vector <double> (n, 0.0));
 
     for (uint i = 0; i < n; i++) {
         for (uint j = i; j < n; j++) {
@@ -299,19 +698,21 @@ int main (int argc, char * argv[]) {
         }
     }
 
-    tSolution solution = grasp(A, seed, timeLimit, searchMethod, alpha, tBegin);
-
-    cout << "maxVal = " << solution.second << endl;
-
-    chrono :: high_resolution_clock :: time_point tEnd = chrono :: high_resolution_clock :: now();
-    chrono :: seconds elapsedTime = chrono :: duration_cast <chrono :: seconds> (tEnd - tBegin);
+    vector <uint> priorSolution;
+    vector <tDelta> deltas;
 
-    cout << "Time = " << elapsedTime.count() << " seg" << endl;
-
-    cout << "Solution: " << endl;
-    for (uint i = 0; i < n; i++) {
-        cout << solution.first[i] << endl;
+    if (warm) {
+        if (!readSolution(n, &priorSolution) || readDelta(n, &deltas) < 0) {
+            return 1;
+        }
     }
 
-    return 0;
+    // integral instances use the integer path, with the narrowest storage that holds the coefficients
+    if (isRepresentable <int16_t> (A)) {
+        return solve(convert <int16_t> (A), warm, priorSolution, deltas, seed, timeLimit, resolveTimeLimit, searchMethod, alpha, tBegin);
+    } else if (isRepresentable <int32_t> (A)) {
+        return solve(convert <int32_t> (A), warm, priorSolution, deltas, seed, timeLimit, resolveTimeLimit, searchMethod, alpha, tBegin);
+    }
+    return solve(A, warm, priorSolution, deltas, seed, timeLimit, resolveTimeLimit, searchMethod, alpha, tBegin);
 }
+
@@ -4,49 +4,110 @@
 #include <chrono>
 #include <iterator>
 #include <set>
+#include <random>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 
 using namespace std;
 
 typedef unsigned int uint;
 typedef long int lint;
 typedef unsigned long int ulint;
-typedef vector < vector <double> > matrix;
-typedef pair < vector <uint>, double > tSolution;
 
-double evaluateUtility (matrix A, vector <uint> solution) {
-    double result = 0.0;
+// integral coefficients are stored in 16 or 32 bits and accumulated in 64 bits
+template <typename T> struct accumulator { typedef lint type; };
+template <> struct accumulator <double> { typedef double type; };
+
+template <typename T> using matrix = vector < vector <T> >;
+template <typename T> using tValue = typename accumulator <T> :: type;
+template <typename V> using tSolution = pair < vector <uint>, V >;
+
+const double EPSILON = 1e-9;
+
+template <typename T>
+tValue <T> evaluateUtility (const matrix <T> & A, const vector <uint> & solution) {
+    tValue <T> result = 0;
     for (uint i = 0; i < A.size(); i++) {
         for (uint j = 0; j < A[i].size(); j++) {
-            result += solution[i] * A[i][j] * solution[j];
+            result += tValue <T> (solution[i]) * A[i][j] * solution[j];
         }
     }
     return result;
 }
 
-double evaluatecontribuition (matrix A, vector <uint> solution, uint i) {
-    double result = A[i][i];
-    for (uint j = 0; j < A[i].size(); j++) {
-        if (i != j) {
-            result += solution[j] * (A[i][j] + A[j][i]);
+template <typename T>
+tValue <T> evaluatecontribuition (const matrix <T> & A, const vector <uint> & solution, uint i) {
+    // the matrix is triangular superior: the column above 'i' and the row after it
+    tValue <T> result = A[i][i];
+    for (uint j = 0; j < i; j++) {
+        result += tValue <T> (solution[j]) * A[j][i];
+    }
+    const T * row = A[i].data();
+    uint n = A.size();
+    for (uint j = i + 1; j < n; j++) {
+        result += tValue <T> (solution[j]) * row[j];
+    }
+    return result;
+}
+
+template <typename T>
+vector < tValue <T> > evaluateGains (const matrix <T> & A, const vector <uint> & solution) {
+    // gains[i] is the utility variation of flipping 'i' (added if 'i' is out, removed if 'i' is in)
+    uint n = A.size();
+    vector < tValue <T> > result (n, 0);
+    for (uint i = 0; i < n; i++) {
+        const T * row = A[i].data();
+        tValue <T> xi = solution[i];
+        tValue <T> sum = row[i];
+        for (uint j = i + 1; j < n; j++) { // the matrix is triangular superior
+            sum += tValue <T> (solution[j]) * row[j];
+            result[j] += xi * row[j];
         }
+        result[i] += sum;
     }
     return result;
 }
 
-tSolution greedyRandomizedConstruction (matrix A, double alpha, default_random_engine generator) {
-    tSolution result = make_pair(vector <uint> (A.size(), 0), 0.0);
+template <typename T>
+void flip (const matrix <T> * A, vector < tValue <T> > * gains, tSolution < tValue <T> > * solution, uint i) {
+    // O(n) update of the solution, its utility and the cached gains
+    tValue <T> sign = 1;
+    if ((*solution).first[i] == 0) {
+        (*solution).first[i] = 1;
+        (*solution).second += (*gains)[i];
+    } else {
+        sign = -1;
+        (*solution).first[i] = 0;
+        (*solution).second -= (*gains)[i];
+    }
+    // the matrix is triangular superior: the column above 'i' and the row after it
+    tValue <T> * g = (*gains).data();
+    for (uint j = 0; j < i; j++) {
+        g[j] += sign * (*A)[j][i];
+    }
+    const T * row = (*A)[i].data();
+    uint n = (*A).size();
+    for (uint j = i + 1; j < n; j++) {
+        g[j] += sign * row[j];
+    }
+}
+
+template <typename T>
+tSolution < tValue <T> > greedyRandomizedConstruction (const matrix <T> & A, double alpha, default_random_engine & generator) {
+    tSolution < tValue <T> > result = make_pair(vector <uint> (A.size(), 0), tValue <T> (0));
     bool flag = true;
     while (flag) {
-        double minUtility = 0, maxUtility = 0;
+        tValue <T> minUtility = 0, maxUtility = 0;
         bool flag2 = true;
-        vector < pair <uint, double> > candidateList;
+        vector < pair <uint, tValue <T> > > candidateList;
         for (uint i = 0; i < A.size(); i++) {
-            tSolution solution;
+            tSolution < tValue <T> > solution;
             solution.first = vector <uint> (result.first);
             solution.second = result.second;
             if (solution.first[i] == 0) { // if 'i' is not in solution
                 solution.first[i] = 1;
-                double contribuition = evaluatecontribuition(A, solution.first, i);
+                tValue <T> contribuition = evaluatecontribuition(A, solution.first, i);
                 solution.second += contribuition;
                 if (solution.second >= result.second) { // if 'i' can improve solution
                     candidateList.push_back(make_pair(i, contribuition));
@@ -67,9 +128,9 @@ tSolution greedyRandomizedConstruction (matrix A, double alpha, default_random_e
         // compute restriction
         double restriction = maxUtility - alpha * (maxUtility - minUtility);
         // populate RCL
-        vector < pair <uint, double> > restrictedCandidateList;
-        for (vector < pair <uint, double> > :: iterator it = candidateList.begin(); it != candidateList.end(); it++) {
-            pair <uint, double> candidate = *it;
+        vector < pair <uint, tValue <T> > > restrictedCandidateList;
+        for (typename vector < pair <uint, tValue <T> > > :: iterator it = candidateList.begin(); it != candidateList.end(); it++) {
+            pair <uint, tValue <T> > candidate = *it;
             if (candidate.second >= restriction) {
                 restrictedCandidateList.push_back(candidate);
             }
@@ -77,9 +138,9 @@ tSolution greedyRandomizedConstruction (matrix A, double alpha, default_random_e
         if (restrictedCandidateList.size() > 0) {
             uniform_int_distribution <uint> distribution (0, restrictedCandidateList.size() - 1);
             uint s = distribution(generator);
-            pair <uint, double> candidate = restrictedCandidateList[s];
+            pair <uint, tValue <T> > candidate = restrictedCandidateList[s];
             uint i = candidate.first;
-            uint deltaUtility = candidate.second;
+            tValue <T> deltaUtility = candidate.second;
             result.first[i] = 1;
             result.second += deltaUtility;
         } else {
@@ -90,7 +151,8 @@ tSolution greedyRandomizedConstruction (matrix A, double alpha, default_random_e
     return result;
 }
 
-bool isFeasible (tSolution solution) {
+template <typename V>
+bool isFeasible (tSolution <V> solution) {
     for (uint i = 0; i < solution.first.size(); i++) {
         if (solution.first[i] == 1) {
             if (i > 0 && solution.first[i - 1] == 1) {
@@ -104,7 +166,8 @@ bool isFeasible (tSolution solution) {
     return true;
 }
 
-void repair (matrix A, tSolution * solution) {
+template <typename T>
+void repair (const matrix <T> & A, tSolution < tValue <T> > * solution) {
     // desligar bits até se tornar factível
     // dar preferencia pros bits que violam mais restricões
     // em caso de empate, dar preferencia pros que diminuem menos a utilidade
@@ -133,16 +196,16 @@ void repair (matrix A, tSolution * solution) {
             if (restrictionsViolatedCounter[chosenBit] < restrictionsViolatedCounter[i]) {
                 chosenBit = i;
             } else if (restrictionsViolatedCounter[chosenBit] == restrictionsViolatedCounter[i]) {
-                tSolution chosenNewSolution;
+                tSolution < tValue <T> > chosenNewSolution;
                 chosenNewSolution.first = vector <uint> ((*solution).first);
                 chosenNewSolution.second = (*solution).second;
-                double chosenContribution = evaluatecontribuition(A, chosenNewSolution.first, chosenBit);
+                tValue <T> chosenContribution = evaluatecontribuition(A, chosenNewSolution.first, chosenBit);
                 chosenNewSolution.first[chosenBit] = 0;
                 chosenNewSolution.second -= chosenContribution;
-                tSolution newSolution;
+                tSolution < tValue <T> > newSolution;
                 newSolution.first = vector <uint> ((*solution).first);
                 newSolution.second = (*solution).second;
-                double newContribution = evaluatecontribuition(A, newSolution.first, i);
+                tValue <T> newContribution = evaluatecontribuition(A, newSolution.first, i);
                 newSolution.first[i] = 0;
                 newSolution.second -= newContribution;
                 if (chosenNewSolution.second < newSolution.second) {
@@ -150,72 +213,199 @@ void repair (matrix A, tSolution * solution) {
                 }
             }
         }
-        double contribuition = evaluatecontribuition(A, (*solution).first, chosenBit);
+        tValue <T> contribuition = evaluatecontribuition(A, (*solution).first, chosenBit);
         (*solution).first[chosenBit] = 0;
         (*solution).second -= contribuition;
         invalidBits.erase(chosenBit);
     }
 }
 
-void localSearch (matrix A, int searchMethod, default_random_engine generator, tSolution * solution) {
-    vector < vector <uint> > neighborhood;
-    // 1Flip neighborhood
-    for (uint i = 0; i < A.size(); i++) {
-        vector <uint> neighbor;
-        neighbor.push_back(i);
-        neighborhood.push_back(neighbor);
+template <typename V>
+uint bitAfterMove (tSolution <V> * solution, const uint * move, uint count, uint p) {
+    // value of bit 'p' once the 'count' bits in 'move' are flipped
+    uint bit = (*solution).first[p];
+    for (uint l = 0; l < count; l++) {
+        if (move[l] == p) {
+            bit = 1 - bit;
+        }
     }
-    // 2Flip neighborhood
-    for (uint i = 0; i < A.size(); i++) {
-        for (uint j = i + 1; j < A.size(); j++) {
-            vector <uint> neighbor;
-            neighbor.push_back(i);
-            neighbor.push_back(j);
-            neighborhood.push_back(neighbor);
+    return bit;
+}
+
+template <typename V>
+bool isFeasibleMove (tSolution <V> * solution, const uint * move, uint count) {
+    // checks only the neighborhood of the flipped bits, assuming the solution is feasible
+    uint n = (*solution).first.size();
+    for (uint l = 0; l < count; l++) {
+        uint i = move[l];
+        if (bitAfterMove(solution, move, count, i) == 1) {
+            if (i > 0 && bitAfterMove(solution, move, count, i - 1) == 1) {
+                return false;
+            }
+            if (i < n - 1 && bitAfterMove(solution, move, count, i + 1) == 1) {
+                return false;
+            }
         }
     }
-    // 3Flip neighborhood
-/*    for (uint i = 0; i < A.size(); i++) {
-        for (uint j = i + 1; j < A.size(); j++) {
-            for (uint k = j + 1; k < A.size(); k++) {
-                vector <uint> neighbor;
-                neighbor.push_back(i);
-                neighbor.push_back(j);
-                neighbor.push_back(k);
-                neighborhood.push_back(neighbor);
+    return true;
+}
+
+template <typename V>
+int sign (tSolution <V> * solution, uint i) {
+    // +1 if flipping 'i' adds it to the solution, -1 if it removes it
+    return (*solution).first[i] == 0 ? 1 : -1;
+}
+
+template <typename T>
+tValue <T> pairTerm (const matrix <T> * A, tSolution < tValue <T> > * solution, uint i, uint j) {
+    // interaction between the flips of 'i' and 'j'
+    return tValue <T> (sign(solution, i) * sign(solution, j)) * (tValue <T> ((*A)[i][j]) + (*A)[j][i]);
+}
+
+template <typename V>
+bool oneFlipMove (vector <V> * delta, vector <uint> * order, int searchMethod, tSolution <V> * solution, vector <uint> * move) {
+    double bestDelta = EPSILON;
+    bool found = false;
+    for (uint a = 0; a < (*order).size() && (*delta)[(*order)[a]] > bestDelta; a++) {
+        uint i = (*order)[a];
+        if (isFeasibleMove(solution, &i, 1)) {
+            found = true;
+            bestDelta = (*delta)[i];
+            *move = vector <uint> (1, i);
+            if (searchMethod == 0) {
+                return true;
             }
         }
     }
-*/
-    shuffle (neighborhood.begin(), neighborhood.end(), generator);
-    bool flag = true;
-    for (vector < vector <uint> > :: iterator it = neighborhood.begin(); flag && it != neighborhood.end(); it++) {
-        vector <uint> neighbor = *it;
-        tSolution newSolution = make_pair(vector <uint> ((*solution).first), (*solution).second);
-        for (vector <uint> :: iterator it2 = neighbor.begin(); it2 != neighbor.end(); it2++) {
-            uint i = *it2;
-            double contribuition = evaluatecontribuition(A, newSolution.first, i);
-            if (newSolution.first[i] == 0) {
-                newSolution.first[i] = 1;
-                newSolution.second += contribuition;
-            } else {
-                newSolution.first[i] = 0;
-                newSolution.second -= contribuition;
+    return found;
+}
+
+template <typename T>
+bool twoFlipMove (const matrix <T> * A, vector < tValue <T> > * delta, vector <uint> * order, int searchMethod, tValue <T> bound, bool swapMove, tSolution < tValue <T> > * solution, vector <uint> * move) {
+    // swap moves pair a bit in the solution with a bit out of it, 2-flip moves pair bits in the same state
+    double bestDelta = EPSILON;
+    bool found = false;
+    uint n = (*order).size();
+    for (uint a = 0; a + 1 < n; a++) {
+        uint i = (*order)[a];
+        if ((*delta)[i] + (*delta)[(*order)[a + 1]] + bound <= bestDelta) {
+            break;
+        }
+        for (uint b = a + 1; b < n; b++) {
+            uint j = (*order)[b];
+            if ((*delta)[i] + (*delta)[j] + bound <= bestDelta) {
+                break;
+            }
+            if (swapMove == ((*solution).first[i] == (*solution).first[j])) {
+                continue;
+            }
+            tValue <T> d = (*delta)[i] + (*delta)[j] + pairTerm(A, solution, i, j);
+            if (d > bestDelta) {
+                uint neighbor[2] = {i, j};
+                if (isFeasibleMove(solution, neighbor, 2)) {
+                    found = true;
+                    bestDelta = d;
+                    *move = vector <uint> (neighbor, neighbor + 2);
+                    if (searchMethod == 0) {
+                        return true;
+                    }
+                }
             }
         }
-/*
-        if (!isFeasible(newSolution)) {
-            repair (A, &newSolution);
+    }
+    return found;
+}
+
+template <typename T>
+bool threeFlipMove (const matrix <T> * A, vector < tValue <T> > * delta, vector <uint> * order, int searchMethod, tValue <T> bound, tSolution < tValue <T> > * solution, vector <uint> * move) {
+    double bestDelta = EPSILON;
+    bool found = false;
+    uint n = (*order).size();
+    for (uint a = 0; a + 2 < n; a++) {
+        uint i = (*order)[a];
+        if ((*delta)[i] + (*delta)[(*order)[a + 1]] + (*delta)[(*order)[a + 2]] + 3 * bound <= bestDelta) {
+            break;
         }
-*/
-        if (isFeasible(newSolution) && newSolution.second > (*solution).second) {
-            (*solution).first = vector <uint> (newSolution.first);
-            (*solution).second = newSolution.second;
-            if (searchMethod == 0) {
-                flag = false;
+        for (uint b = a + 1; b + 1 < n; b++) {
+            uint j = (*order)[b];
+            if ((*delta)[i] + (*delta)[j] + (*delta)[(*order)[b + 1]] + 3 * bound <= bestDelta) {
+                break;
+            }
+            tValue <T> dij = (*delta)[i] + (*delta)[j] + pairTerm(A, solution, i, j);
+            for (uint c = b + 1; c < n; c++) {
+                uint k = (*order)[c];
+                if (dij + (*delta)[k] + 2 * bound <= bestDelta) {
+                    break;
+                }
+                tValue <T> d = dij + (*delta)[k] + pairTerm(A, solution, i, k) + pairTerm(A, solution, j, k);
+                if (d > bestDelta) {
+                    uint neighbor[3] = {i, j, k};
+                    if (isFeasibleMove(solution, neighbor, 3)) {
+                        found = true;
+                        bestDelta = d;
+                        *move = vector <uint> (neighbor, neighbor + 3);
+                        if (searchMethod == 0) {
+                            return true;
+                        }
+                    }
+                }
             }
         }
     }
+    return found;
+}
+
+template <typename T>
+void variableNeighborhoodDescent (const matrix <T> * A, vector < tValue <T> > * gains, int searchMethod, default_random_engine & generator, tSolution < tValue <T> > * solution) {
+    // cycles 1-flip -> swap -> 2-flip -> 3-flip, restarting from 1-flip after each improvement
+    // moves are evaluated from the cached gains and pairwise terms, visiting the bits in
+    // decreasing order of their 1-flip delta so that pairs and triples whose delta is bounded
+    // by the best move found so far are pruned
+    uint n = (*A).size();
+    tValue <T> bound = 0; // largest absolute pairwise term
+    for (uint i = 0; i < n; i++) {
+        for (uint j = i + 1; j < n; j++) {
+            bound = max(bound, abs(tValue <T> ((*A)[i][j]) + (*A)[j][i]));
+        }
+    }
+    vector <uint> order (n);
+    for (uint i = 0; i < n; i++) {
+        order[i] = i;
+    }
+    vector < tValue <T> > delta (n);
+    uint k = 0;
+    while (k < 4) {
+        for (uint i = 0; i < n; i++) {
+            delta[i] = sign(solution, i) * (*gains)[i];
+        }
+        shuffle(order.begin(), order.end(), generator); // ties are broken at random
+        stable_sort(order.begin(), order.end(), [&delta] (uint i, uint j) { return delta[i] > delta[j]; });
+        vector <uint> move;
+        bool found = false;
+        if (k == 0) {
+            found = oneFlipMove(&delta, &order, searchMethod, solution, &move);
+        } else if (k == 1) {
+            found = twoFlipMove(A, &delta, &order, searchMethod, bound, true, solution, &move);
+        } else if (k == 2) {
+            found = twoFlipMove(A, &delta, &order, searchMethod, bound, false, solution, &move);
+        } else {
+            found = threeFlipMove(A, &delta, &order, searchMethod, bound, solution, &move);
+        }
+        if (found) {
+            for (vector <uint> :: iterator it = move.begin(); it != move.end(); it++) {
+                flip(A, gains, solution, *it);
+            }
+            k = 0;
+        } else {
+            k++;
+        }
+    }
+}
+
+template <typename T>
+void localSearch (const matrix <T> & A, int searchMethod, default_random_engine & generator, tSolution < tValue <T> > * solution) {
+    vector < tValue <T> > gains = evaluateGains(A, (*solution).first);
+    variableNeighborhoodDescent(&A, &gains, searchMethod, generator, solution);
 }
 
 bool termination (chrono :: high_resolution_clock :: time_point tBegin, ulint timeLimit) {
@@ -239,8 +429,9 @@ double average (vector <double> v) {
     return result;
 }
 
-tSolution grasp (matrix A, ulint seed, ulint timeLimit, int searchMethod, vector < pair < double, pair <double, vector <double> > > > psi, chrono :: high_resolution_clock :: time_point tBegin) {
-    tSolution result;
+template <typename T>
+tSolution < tValue <T> > grasp (const matrix <T> & A, ulint seed, ulint timeLimit, int searchMethod, vector < pair < double, pair <double, vector <double> > > > psi, chrono :: high_resolution_clock :: time_point tBegin) {
+    tSolution < tValue <T> > result;
 
     default_random_engine generator (seed);
 
@@ -261,15 +452,15 @@ tSolution grasp (matrix A, ulint seed, ulint timeLimit, int searchMethod, vector
         }
         cout << "alpha: " << alpha << endl;
         cout << "vai entrar greedyRandomizedConstruction" << endl;
-        tSolution solution = greedyRandomizedConstruction(A, alpha, generator);
+        tSolution < tValue <T> > solution = greedyRandomizedConstruction(A, alpha, generator);
         cout << "saiu greedyRandomizedConstruction" << endl;
-        cout << "vai entrar localSearch" << endl;
-        localSearch(A, searchMethod, generator, &solution);
-        cout << "saiu localSearch" << endl;
         if (!isFeasible(solution)) {
             repair(A, &solution);
         }
         cout << "reparou se necessario" << endl;
+        cout << "vai entrar localSearch" << endl;
+        localSearch(A, searchMethod, generator, &solution);
+        cout << "saiu localSearch" << endl;
 
         if (flag || result.second < solution.second) {
             flag = false;
@@ -307,11 +498,66 @@ tSolution grasp (matrix A, ulint seed, ulint timeLimit, int searchMethod, vector
     return result;
 }
 
+template <typename T>
+bool isRepresentable (double value) {
+    return value >= numeric_limits <T> :: lowest() && value <= numeric_limits <T> :: max() && T (value) == value;
+}
+
+template <typename T>
+bool isRepresentable (const matrix <double> & A) {
+    for (uint i = 0; i < A.size(); i++) {
+        for (uint j = 0; j < A[i].size(); j++) {
+            if (!isRepresentable <T> (A[i][j])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename T>
+matrix <T> convert (const matrix <double> & A) {
+    matrix <T> result (A.size(), vector <T> (A.size(), 0));
+    for (uint i = 0; i < A.size(); i++) {
+        for (uint j = 0; j < A[i].size(); j++) {
+            result[i][j] = T (A[i][j]);
+        }
+    }
+    return result;
+}
+
+template <typename T>
+void solve (matrix <T> A, ulint seed, ulint timeLimit, int searchMethod, vector < pair < double, pair <double, vector <double> > > > psi, chrono :: high_resolution_clock :: time_point tBegin) {
+    tSolution < tValue <T> > solution = grasp(A, seed, timeLimit, searchMethod, psi, tBegin);
+
+    cout << "qwqeqwe" << endl;
+
+    cout << "maxVal = " << solution.second << endl << endl;
+
+    chrono :: high_resolution_clock :: time_point tEnd = chrono :: high_resolution_clock :: now();
+    chrono :: seconds elapsedTime = chrono :: duration_cast <chrono :: seconds> (tEnd - tBegin);
+
+    cout << "Time = " << elapsedTime.count() << " seg" << endl << endl;
+
+    cout << "Solution: " << endl;
+    for (uint i = 0; i < solution.first.size(); i++) {
+        cout << solution.first[i] << endl;
+    }
+    cout << endl;
+
+    cout << "Psi: " << endl;
+    cout << "alpha - p - A" << endl;
+    for (uint i = 0; i < psi.size(); i++) {
+        cout << psi[i].first << " - " << psi[i].second.first << " - " << average(psi[i].second.second) << endl;;
+    }
+    cout << endl;
+}
+
 int main (int argc, char * argv[]) {
     chrono :: high_resolution_clock :: time_point tBegin = chrono :: high_resolution_clock :: now();
     ulint seed = 0;
     ulint timeLimit = 10;
-    int searchMethod; // 0 = first-improving; 1 = best-improving
+    int searchMethod = 0; // 0 = first-improving; 1 = best-improving
     uint m = 1;
 
     if (argc >= 2) {
@@ -359,7 +605,7 @@ int main (int argc, char * argv[]) {
 
     cin >> n;
 
-    matrix A (n, vector <double> (n, 0.0));
+    matrix <double> A (n, vector <double> (n, 0.0));
 
     for (uint i = 0; i < n; i++) {
         for (uint j = i; j < n; j++) {
@@ -367,29 +613,14 @@ int main (int argc, char * argv[]) {
         }
     }
 
-    tSolution solution = grasp(A, seed, timeLimit, searchMethod, psi, tBegin);
-
-    cout << "qwqeqwe" << endl;
-
-    cout << "maxVal = " << solution.second << endl << endl;
-
-    chrono :: high_resolution_clock :: time_point tEnd = chrono :: high_resolution_clock :: now();
-    chrono :: seconds elapsedTime = chrono :: duration_cast <chrono :: seconds> (tEnd - tBegin);
-
-    cout << "Time = " << elapsedTime.count() << " seg" << endl << endl;
-
-    cout << "Solution: " << endl;
-    for (uint i = 0; i < n; i++) {
-        cout << solution.first[i] << endl;
+    // integral instances use the integer path, with the narrowest storage that holds the coefficients
+    if (isRepresentable <int16_t> (A)) {
+        solve(convert <int16_t> (A), seed, timeLimit, searchMethod, psi, tBegin);
+    } else if (isRepresentable <int32_t> (A)) {
+        solve(convert <int32_t> (A), seed, timeLimit, searchMethod, psi, tBegin);
+    } else {
+        solve(A, seed, timeLimit, searchMethod, psi, tBegin);
     }
-    cout << endl;
-
-    cout << "Psi: " << endl;
-    cout << "alpha - p - A" << endl;
-    for (uint i = 0; i < psi.size(); i++) {
-        cout << psi[i].first << " - " << psi[i].second.first << " - " << average(psi[i].second.second) << endl;;
-    }
-    cout << endl;
 
     return 0;
 }